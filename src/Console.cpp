@@ -17,10 +17,14 @@ bool DragBar::init() {
     setTouchEnabled(true);
     scheduleUpdate();
 
-    CCLabelBMFont* logsLabel = CCLabelBMFont::create("Logs", "Consolas.fnt"_spr);
-    logsLabel->setAnchorPoint({0, 0.5f});
-    logsLabel->setScale(0.3f);
-    logsLabel->setPosition({11, 4.5});
+    m_logsLabel = CCLabelBMFont::create("Logs", "Consolas.fnt"_spr);
+    m_logsLabel->setAnchorPoint({0, 0.5f});
+    m_logsLabel->setScale(0.3f);
+    m_logsLabel->setPosition({11, 4.5});
+
+    m_exportLabel = CCLabelBMFont::create("Export", "Consolas.fnt"_spr);
+    m_exportLabel->setScale(0.3f);
+    m_exportLabel->setOpacity(127);
 
     m_resizeSprite = CCSprite::create("resize.png"_spr);
     m_resizeSprite->setAnchorPoint({1, 1});
@@ -38,13 +42,15 @@ bool DragBar::init() {
 
     schedule(schedule_selector(DragBar::resizeSchedule), 0.0083);
 
-    addChild(logsLabel);
+    addChild(m_logsLabel);
+    addChild(m_exportLabel);
 
     if (Mod::get()->getSavedValue<bool>("isMinimized", false)) {
         m_minimized = true;
         m_minimizeSprite->setDisplayFrame(CCSprite::create("unminimize.png"_spr)->displayFrame());
         m_resizeSprite->setVisible(false);
     }
+    updateExportLabel();
 
     return true;
 }
@@ -73,6 +79,7 @@ void DragBar::setMinimized(bool minimized) {
         m_minimizeSprite->setDisplayFrame(CCSprite::create("minimize.png"_spr)->displayFrame());
         m_resizeSprite->setVisible(true);
     }
+    updateExportLabel();
 }
 
 void DragBar::registerWithTouchDispatcher() {
@@ -88,6 +95,58 @@ void DragBar::setContentSize(const CCSize& size) {
     if (m_resizeSprite) {
         m_resizeSprite->setPosition(getContentSize());
     }
+    if (m_exportLabel) {
+        updateExportLabel();
+    }
+}
+
+void DragBar::update(float dt) {
+    ExportStatus status = LogExport::getStatus();
+    if (status != m_exportStatus) {
+        m_exportStatus = status;
+        m_statusTime = 3;
+    }
+    if (m_statusTime > 0) m_statusTime -= dt;
+
+    std::string header = "Logs";
+    switch (status) {
+        case ExportStatus::Running:
+            header = fmt::format("Logs ({}%)", static_cast<int>(LogExport::getProgress() * 100));
+            break;
+        case ExportStatus::Saved:
+            if (m_statusTime > 0) header = "Logs - Saved";
+            break;
+        case ExportStatus::Failed:
+            if (m_statusTime > 0) header = "Logs - Export failed";
+            break;
+        case ExportStatus::Cancelled:
+            if (m_statusTime > 0) header = "Logs - Cancelled";
+            break;
+        default:
+            break;
+    }
+
+    if (header != m_logsLabel->getString()) {
+        m_logsLabel->setString(header.c_str());
+        updateExportLabel();
+    }
+}
+
+void DragBar::updateExportLabel() {
+    bool running = LogExport::isRunning();
+    m_exportLabel->setString(running ? "Cancel" : "Export");
+
+    // While minimized the bar is too narrow, so Cancel follows the header instead
+    if (m_minimized) {
+        m_exportLabel->setVisible(running);
+        m_exportLabel->setAnchorPoint({0, 0.5f});
+        m_exportLabel->setPosition({m_logsLabel->getPositionX() + m_logsLabel->getScaledContentWidth() + 4, 4.5});
+    }
+    else {
+        m_exportLabel->setVisible(true);
+        m_exportLabel->setAnchorPoint({1, 0.5f});
+        m_exportLabel->setPosition({getContentWidth() - 11, 4.5});
+    }
 }
 
 bool DragBar::ccTouchBegan(CCTouch* touch, CCEvent* event) {
@@ -100,6 +159,19 @@ bool DragBar::ccTouchBegan(CCTouch* touch, CCEvent* event) {
 
     if (m_minimized) width += 10;
 
+    if (m_exportLabel->isVisible()) {
+        CCRect exportBounds = m_exportLabel->boundingBox();
+        exportBounds.origin.y = 0;
+        exportBounds.size.height = this->getContentSize().height;
+        if (exportBounds.containsPoint(locationInNode)) {
+            m_exportLabel->setOpacity(255);
+            if (LogExport::isRunning()) LogExport::cancel();
+            else static_cast<Console*>(m_nodeToMove)->exportHistory();
+            updateExportLabel();
+            return true;
+        }
+    }
+
     CCRect bounds = CCRect(10, 0, width, this->getContentSize().height);
     if (bounds.containsPoint(locationInNode)) {
         m_lastTouchPos = locationInView;
@@ -191,6 +263,7 @@ void DragBar::ccTouchEnded(CCTouch* touch, CCEvent* event) {
     m_resizing = false;
     m_resizeSprite->setOpacity(64);
     m_minimizeSprite->setOpacity(64);
+    m_exportLabel->setOpacity(127);
 }
 
 void DragBar::ccTouchCancelled(CCTouch* touch, CCEvent* event) {
@@ -198,6 +271,7 @@ void DragBar::ccTouchCancelled(CCTouch* touch, CCEvent* event) {
     m_resizing = false;
     m_resizeSprite->setOpacity(64);
     m_minimizeSprite->setOpacity(64);
+    m_exportLabel->setOpacity(127);
 }
 
 Console* Console::s_instance = nullptr;
@@ -219,11 +293,17 @@ Console* Console::get() {
 
 Console::~Console() {
     s_instance = nullptr;
+    LogExport::cancelAndWait();
 }
 
 bool Console::init() {
     if (!CCLayerColor::initWithColor({0, 0, 0, 220})) return false;
     this->setZOrder(100);
+    m_historySize = Mod::get()->getSettingValue<int64_t>("history-size");
+    listenForSettingChanges("history-size", [](int64_t size) {
+        if (auto console = Console::get()) console->setHistorySize(size);
+    });
+
     m_blockMenu = CCMenu::create();
     m_blockMenu->ignoreAnchorPointForPosition(false);
     m_blockMenuItem = CCMenuItemSpriteExtra::create(CCNode::create(), this, nullptr);
@@ -343,6 +423,11 @@ int calculateOffset(Log log) {
 }
 
 void Console::pushLog(Log log) {
+    m_history.push_back(std::make_shared<const Log>(log));
+    while (m_history.size() > m_historySize) {
+        m_history.pop_front();
+    }
+
     if (m_scrollLayer->m_contentLayer->getChildrenCount() > 500) {
         static_cast<CCNode*>(m_scrollLayer->m_contentLayer->getChildren()->objectAtIndex(0))->removeFromParent();
     }
@@ -373,6 +458,26 @@ void Console::pushLog(Log log) {
     m_scrollLayer->m_contentLayer->setPosition(m_scrollLayer->m_contentLayer->getPosition());
 }
 
+void Console::exportHistory() {
+    ExportFormat format = LogExport::formatFromString(Mod::get()->getSettingValue<std::string>("export-format"));
+    Severity minSeverity = fromString(Mod::get()->getSettingValue<std::string>("export-filter"));
+
+    auto result = LogExport::start(std::vector<std::shared_ptr<const Log>>(m_history.begin(), m_history.end()), format, minSeverity);
+    if (result.isOk()) {
+        log::info("Exporting logs to {}", result.unwrap());
+    }
+    else {
+        log::error("Export failed: {}", result.unwrapErr());
+    }
+}
+
+void Console::setHistorySize(size_t size) {
+    m_historySize = size;
+    while (m_history.size() > m_historySize) {
+        m_history.pop_front();
+    }
+}
+
 CCNode* Console::createCell(Log log) {
     LogCell* logCell = LogCell::create(log, getContentSize());
 
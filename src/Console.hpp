@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Geode/Geode.hpp>
+#include "Export.hpp"
 
 using namespace geode::prelude;
 struct Log {
@@ -13,6 +14,8 @@ struct Log {
     int offset;
 };
 
+Severity fromString(std::string severity);
+
 class LogCell : public CCNode {
 protected:
     Log m_log;
@@ -29,18 +32,24 @@ protected:
     CCNode* m_nodeToMove;
     CCSprite* m_resizeSprite;
     CCSprite* m_minimizeSprite;
+    CCLabelBMFont* m_logsLabel;
+    CCLabelBMFont* m_exportLabel;
     cocos2d::CCPoint m_lastTouchPos;
     bool m_dragging = false;
     bool m_resizing = false;
     bool m_minimized = false;
     CCSize m_queuedSize = {300, 150};
     CCSize m_expectedContentSize = {300, 150};
+    ExportStatus m_exportStatus = ExportStatus::Idle;
+    float m_statusTime = 0;
 
 public:
     static DragBar* create();
     bool init() override;
     void setContentSize(const CCSize& size) override;
     void resizeSchedule(float dt);
+    void update(float dt) override;
+    void updateExportLabel();
     void setMinimized(bool minimized);
     void setNodeToMove(CCNode* node);
     void registerWithTouchDispatcher() override;
@@ -58,6 +67,8 @@ protected:
     CCMenu* m_blockMenu;
     CCMenuItemSpriteExtra* m_blockMenuItem;
     DragBar* m_dragBar;
+    std::deque<std::shared_ptr<const Log>> m_history;
+    size_t m_historySize;
     bool m_minimized = false;
 
 public:
@@ -74,5 +85,7 @@ public:
 
     CCNode* createCell(Log log);
     void pushLog(Log log);
+    void exportHistory();
+    void setHistorySize(size_t size);
 
 };
\ No newline at end of file
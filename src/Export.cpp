@@ -0,0 +1,218 @@
+#include "Export.hpp"
+#include "Console.hpp"
+#include <fstream>
+#include <zlib.h>
+
+std::shared_ptr<LogExport::Task> LogExport::s_task = nullptr;
+
+class ExportSink {
+protected:
+    std::ofstream m_stream;
+    bool m_compress = false;
+    z_stream m_zstream{};
+    char m_buffer[16384];
+
+    bool deflateBuffer(std::string_view data, int flush) {
+        m_zstream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        m_zstream.avail_in = static_cast<uInt>(data.size());
+        do {
+            m_zstream.next_out = reinterpret_cast<Bytef*>(m_buffer);
+            m_zstream.avail_out = sizeof(m_buffer);
+            if (deflate(&m_zstream, flush) == Z_STREAM_ERROR) return false;
+            m_stream.write(m_buffer, sizeof(m_buffer) - m_zstream.avail_out);
+        } while (m_zstream.avail_out == 0);
+        return m_stream.good();
+    }
+
+public:
+    ~ExportSink() {
+        if (m_compress) deflateEnd(&m_zstream);
+    }
+
+    bool open(const std::filesystem::path& path, bool compress) {
+        m_stream.open(path, std::ios::binary);
+        if (!m_stream.is_open()) return false;
+        if (compress) {
+            // 15 window bits + 16 makes zlib emit a gzip header and trailer
+            if (deflateInit2(&m_zstream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) return false;
+            m_compress = true;
+        }
+        return true;
+    }
+
+    bool write(std::string_view data) {
+        if (m_compress) return deflateBuffer(data, Z_NO_FLUSH);
+        m_stream.write(data.data(), data.size());
+        return m_stream.good();
+    }
+
+    bool finish() {
+        if (m_compress && !deflateBuffer({}, Z_FINISH)) return false;
+        m_stream.close();
+        return !m_stream.fail();
+    }
+};
+
+std::string_view severityName(Severity severity) {
+    switch (severity.m_value) {
+        case Severity::Debug: return "DEBUG";
+        case Severity::Info: return "INFO ";
+        case Severity::Warning: return "WARN ";
+        case Severity::Error: return "ERROR";
+        default: return "?????";
+    }
+}
+
+void formatText(std::string& out, const Log& log) {
+    std::string prefix = fmt::format("{:%H:%M:%S} {}", log.time, severityName(log.severity));
+
+    if (log.threadName.empty())
+        prefix += fmt::format(" [{}]: ", log.mod->getName());
+    else
+        prefix += fmt::format(" [{}] [{}]: ", log.threadName, log.mod->getName());
+
+    bool firstLine = true;
+    for (const std::string& line : geode::utils::string::split(log.message, "\n")) {
+        if (firstLine) out += prefix;
+        else out.append(prefix.size(), ' ');
+        out += line;
+        out += '\n';
+        firstLine = false;
+    }
+}
+
+void formatJson(std::string& out, const Log& log) {
+    matjson::Value value;
+    value["time"] = fmt::format("{:%Y-%m-%d %H:%M:%S}", log.time);
+    value["severity"] = geode::utils::string::trim(std::string(severityName(log.severity)));
+    value["thread"] = log.threadName;
+    value["mod"] = log.mod->getID();
+    value["message"] = log.message;
+    out += value.dump(matjson::NO_INDENTATION);
+    out += '\n';
+}
+
+Result<std::filesystem::path> LogExport::run(Task& task) {
+    ExportSink sink;
+    if (!sink.open(task.path, task.format == ExportFormat::Gzip)) {
+        return Err("Unable to open {}", task.path);
+    }
+
+    std::string buffer;
+    buffer.reserve(65536);
+
+    for (const auto& entry : task.logs) {
+        if (task.cancelled) break;
+        task.processed++;
+        const Log& log = *entry;
+        if (log.severity < task.minSeverity) continue;
+
+        if (task.format == ExportFormat::JsonLines) formatJson(buffer, log);
+        else formatText(buffer, log);
+        task.written++;
+
+        if (buffer.size() >= 65536) {
+            if (!sink.write(buffer)) return Err("Failed writing to {}", task.path);
+            buffer.clear();
+        }
+    }
+
+    if (!task.cancelled) {
+        if (!sink.write(buffer) || !sink.finish()) return Err("Failed writing to {}", task.path);
+    }
+    return Ok(task.path);
+}
+
+Result<std::filesystem::path> LogExport::start(std::vector<std::shared_ptr<const Log>> logs, ExportFormat format, Severity minSeverity) {
+    if (isRunning()) return Err("An export is already running");
+
+    std::filesystem::path dir = Mod::get()->getSaveDir() / "exports";
+    if (file::createDirectoryAll(dir).isErr()) {
+        return Err("Unable to create export directory {}", dir);
+    }
+
+    std::string extension;
+    switch (format) {
+        case ExportFormat::Text: extension = ".log"; break;
+        case ExportFormat::JsonLines: extension = ".jsonl"; break;
+        case ExportFormat::Gzip: extension = ".log.gz"; break;
+    }
+
+    auto now = std::chrono::system_clock::now();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+    std::string stem = fmt::format("relog-{:%Y%m%d-%H%M%S}-{:03}", fmt::localtime(std::chrono::system_clock::to_time_t(now)), millis);
+
+    std::filesystem::path path = dir / (stem + extension);
+    for (int i = 1; std::filesystem::exists(path); i++) {
+        path = dir / fmt::format("{}-{}{}", stem, i, extension);
+    }
+
+    auto task = std::make_shared<Task>();
+    task->total = logs.size();
+    task->logs = std::move(logs);
+    task->format = format;
+    task->minSeverity = minSeverity;
+    task->path = path;
+    s_task = task;
+
+    std::thread([task] {
+        thread::setName("Relog Export");
+        auto result = run(*task);
+
+        if (task->cancelled) {
+            std::error_code ec;
+            std::filesystem::remove(task->path, ec);
+            task->status = ExportStatus::Cancelled;
+            log::info("Export cancelled");
+        }
+        else if (result.isOk()) {
+            task->status = ExportStatus::Saved;
+            log::info("Exported {} logs to {}", task->written, result.unwrap());
+        }
+        else {
+            std::error_code ec;
+            std::filesystem::remove(task->path, ec);
+            task->status = ExportStatus::Failed;
+            log::error("Export failed: {}", result.unwrapErr());
+        }
+
+        // Release the snapshot from the worker rather than the main thread
+        task->logs = {};
+        std::lock_guard lock(task->mutex);
+        task->finished = true;
+        task->finishedCv.notify_all();
+    }).detach();
+
+    return Ok(path);
+}
+
+void LogExport::cancel() {
+    if (s_task) s_task->cancelled = true;
+}
+
+void LogExport::cancelAndWait() {
+    if (!s_task) return;
+    s_task->cancelled = true;
+    std::unique_lock lock(s_task->mutex);
+    s_task->finishedCv.wait(lock, [] { return s_task->finished.load(); });
+}
+
+bool LogExport::isRunning() {
+    return s_task && !s_task->finished;
+}
+
+ExportStatus LogExport::getStatus() {
+    if (!s_task) return ExportStatus::Idle;
+    return s_task->status;
+}
+
+float LogExport::getProgress() {
+    if (!s_task || s_task->total == 0) return 0;
+    return static_cast<float>(s_task->processed) / s_task->total;
+}
+
+ExportFormat LogExport::formatFromString(std::string format) {
+    if (format == "jsonl") return ExportFormat::JsonLines;
+    if (format == "gzip") return ExportFormat::Gzip;
+    return ExportFormat::Text;
+}
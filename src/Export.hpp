@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Geode/Geode.hpp>
+
+using namespace geode::prelude;
+
+struct Log;
+
+enum class ExportFormat {
+    Text,
+    JsonLines,
+    Gzip
+};
+
+enum class ExportStatus {
+    Idle,
+    Running,
+    Saved,
+    Failed,
+    Cancelled
+};
+
+class LogExport {
+protected:
+    struct Task {
+        std::vector<std::shared_ptr<const Log>> logs;
+        ExportFormat format;
+        Severity minSeverity;
+        std::filesystem::path path;
+        size_t total = 0;
+        size_t written = 0;
+        std::atomic<ExportStatus> status = ExportStatus::Running;
+        std::atomic<size_t> processed = 0;
+        std::atomic<bool> cancelled = false;
+        std::atomic<bool> finished = false;
+        std::mutex mutex;
+        std::condition_variable finishedCv;
+    };
+
+    static std::shared_ptr<Task> s_task;
+    static Result<std::filesystem::path> run(Task& task);
+
+public:
+    static Result<std::filesystem::path> start(std::vector<std::shared_ptr<const Log>> logs, ExportFormat format, Severity minSeverity);
+    static void cancel();
+    static void cancelAndWait();
+    static bool isRunning();
+    static ExportStatus getStatus();
+    static float getProgress();
+    static ExportFormat formatFromString(std::string format);
+};
@@ -0,0 +1,330 @@
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+using socket_t = SOCKET;
+#define closeSocket closesocket
+#define pollSockets WSAPoll
+#define SHUT_RDWR SD_BOTH
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+using socket_t = int;
+#define closeSocket close
+#define pollSockets poll
+#define INVALID_SOCKET -1
+#endif
+
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+#include "TailServer.hpp"
+
+// Frames and bytes queued per client before new frames are dropped
+constexpr size_t MAX_QUEUED_FRAMES = 4096;
+constexpr size_t MAX_QUEUED_BYTES = 1 << 20;
+// Upper bound on the bytes gathered into a single send
+constexpr size_t MAX_BATCH_SIZE = 65536;
+// How often the accept loop checks whether the server was stopped
+constexpr int ACCEPT_POLL_MS = 100;
+
+struct TailServer::Client {
+    socket_t socket;
+    std::deque<std::shared_ptr<const std::string>> queue;
+    size_t queuedBytes = 0;
+    uint64_t dropped = 0;
+    bool closed = false;
+    std::condition_variable cv;
+
+    // Closed only once neither the sender nor the accept loop's poll can still use it
+    ~Client() {
+        closeSocket(socket);
+    }
+};
+
+template <class T>
+void appendInt(std::string& out, T value) {
+    for (size_t i = 0; i < sizeof(T); i++) {
+        out += static_cast<char>((static_cast<uint64_t>(value) >> (i * 8)) & 0xFF);
+    }
+}
+
+template <class T>
+void appendString(std::string& out, std::string_view value) {
+    value = value.substr(0, std::numeric_limits<T>::max());
+    appendInt<T>(out, static_cast<T>(value.size()));
+    out += value;
+}
+
+void beginFrame(std::string& out, uint8_t type) {
+    appendInt<uint32_t>(out, 0);
+    out += static_cast<char>(type);
+}
+
+void endFrame(std::string& out, size_t start) {
+    uint32_t length = static_cast<uint32_t>(out.size() - start - sizeof(uint32_t));
+    for (size_t i = 0; i < sizeof(uint32_t); i++) {
+        out[start + i] = static_cast<char>((length >> (i * 8)) & 0xFF);
+    }
+}
+
+int lastSocketError() {
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+// Errors after which accept() or poll() can simply be retried
+bool isTransientError(int error) {
+#ifdef _WIN32
+    return error == WSAEINTR || error == WSAECONNABORTED || error == WSAECONNRESET || error == WSAEWOULDBLOCK;
+#else
+    return error == EINTR || error == ECONNABORTED || error == EAGAIN || error == EWOULDBLOCK;
+#endif
+}
+
+bool setBlocking(socket_t socket, bool blocking) {
+#ifdef _WIN32
+    u_long nonBlocking = blocking ? 0 : 1;
+    return ioctlsocket(socket, FIONBIO, &nonBlocking) == 0;
+#else
+    int flags = fcntl(socket, F_GETFL, 0);
+    if (flags < 0) return false;
+    flags = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+    return fcntl(socket, F_SETFL, flags) == 0;
+#endif
+}
+
+bool sendAll(socket_t socket, std::string_view data) {
+    while (!data.empty()) {
+        int sent = send(socket, data.data(), static_cast<int>(data.size()), SEND_FLAGS);
+        if (sent <= 0) return false;
+        data.remove_prefix(sent);
+    }
+    return true;
+}
+
+TailServer* TailServer::get() {
+    // Never destroyed, so a server still running at exit does not terminate on ~thread
+    static TailServer* instance = new TailServer();
+    return instance;
+}
+
+bool TailServer::start(uint16_t port) {
+    if (m_listening) return true;
+    // Reap an accept loop that exited on its own
+    stop();
+
+#ifdef _WIN32
+    static bool winsockReady = [] {
+        WSADATA wsaData;
+        return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+    }();
+    if (!winsockReady) {
+        log::error("Unable to initialize Winsock");
+        return false;
+    }
+#endif
+
+    socket_t listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSocket == INVALID_SOCKET) {
+        log::error("Unable to create tail server socket");
+        return false;
+    }
+
+    // SO_REUSEADDR on Windows would let another process bind the same port alongside us
+    int reuse = 1;
+#ifdef _WIN32
+    setsockopt(listenSocket, SOL_SOCKET, SO_EXCLUSIVEADDRUSE, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+#else
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+#endif
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (!setBlocking(listenSocket, false) || bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenSocket, 4) != 0) {
+        log::error("Unable to listen on 127.0.0.1:{}", port);
+        closeSocket(listenSocket);
+        return false;
+    }
+
+    m_listenSocket = static_cast<intptr_t>(listenSocket);
+    m_running = true;
+    m_listening = true;
+    m_acceptThread = std::thread([this] {
+        thread::setName("Relog Tail");
+        acceptLoop();
+        m_listening = false;
+    });
+
+    log::info("Tail server listening on 127.0.0.1:{}", port);
+    return true;
+}
+
+void TailServer::stop() {
+    if (!m_acceptThread.joinable()) return;
+    m_running = false;
+
+    m_acceptThread.join();
+    closeSocket(static_cast<socket_t>(m_listenSocket));
+    m_listenSocket = -1;
+
+    std::lock_guard lock(m_mutex);
+    for (auto& client : m_clients) {
+        client->closed = true;
+        shutdown(client->socket, SHUT_RDWR);
+        client->cv.notify_one();
+    }
+}
+
+bool TailServer::isRunning() {
+    return m_listening;
+}
+
+void TailServer::acceptLoop() {
+    socket_t listenSocket = static_cast<socket_t>(m_listenSocket);
+
+    std::vector<pollfd> pollFds;
+    char discard[512];
+
+    while (m_running) {
+        std::vector<std::shared_ptr<Client>> clients;
+        {
+            std::lock_guard lock(m_mutex);
+            clients = m_clients;
+        }
+
+        pollFds.assign(clients.size() + 1, pollfd{});
+        pollFds[0].fd = listenSocket;
+        pollFds[0].events = POLLIN;
+        for (size_t i = 0; i < clients.size(); i++) {
+            pollFds[i + 1].fd = clients[i]->socket;
+            pollFds[i + 1].events = POLLIN;
+        }
+
+        int ready = pollSockets(pollFds.data(), static_cast<unsigned long>(pollFds.size()), ACCEPT_POLL_MS);
+        if (ready == 0) continue;
+        if (ready < 0) {
+            int error = lastSocketError();
+            if (isTransientError(error)) continue;
+            log::error("Tail server went down: poll failed with error {}", error);
+            break;
+        }
+
+        // Clients never send anything, so a readable socket has hung up unless it sent stray bytes
+        for (size_t i = 0; i < clients.size(); i++) {
+            if (pollFds[i + 1].revents == 0) continue;
+            if (recv(clients[i]->socket, discard, sizeof(discard), 0) > 0) continue;
+
+            std::lock_guard lock(m_mutex);
+            clients[i]->closed = true;
+            clients[i]->cv.notify_one();
+        }
+
+        if (!(pollFds[0].revents & POLLIN)) continue;
+
+        socket_t socket = accept(listenSocket, nullptr, nullptr);
+        if (socket == INVALID_SOCKET) {
+            int error = lastSocketError();
+            if (isTransientError(error)) continue;
+            log::error("Tail server went down: accept failed with error {}", error);
+            break;
+        }
+
+        // Accepted sockets inherit non-blocking mode on Windows and Darwin
+        setBlocking(socket, true);
+
+        int noDelay = 1;
+        setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+#ifdef SO_NOSIGPIPE
+        int noSigPipe = 1;
+        setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+        auto client = std::make_shared<Client>();
+        client->socket = socket;
+        {
+            std::lock_guard lock(m_mutex);
+            m_clients.push_back(client);
+            m_clientCount = m_clients.size();
+        }
+
+        std::thread([this, client] {
+            thread::setName("Relog Tail Client");
+            clientLoop(client);
+        }).detach();
+    }
+}
+
+void TailServer::clientLoop(std::shared_ptr<Client> client) {
+    std::string batch;
+    std::unique_lock lock(m_mutex);
+
+    while (true) {
+        client->cv.wait(lock, [&] {
+            return client->closed || client->dropped > 0 || !client->queue.empty();
+        });
+        if (client->closed) break;
+
+        batch.clear();
+        if (client->dropped > 0) {
+            size_t start = batch.size();
+            beginFrame(batch, 1);
+            appendInt<uint64_t>(batch, client->dropped);
+            endFrame(batch, start);
+            client->dropped = 0;
+        }
+        while (!client->queue.empty() && batch.size() < MAX_BATCH_SIZE) {
+            batch += *client->queue.front();
+            client->queuedBytes -= client->queue.front()->size();
+            client->queue.pop_front();
+        }
+
+        lock.unlock();
+        bool sent = sendAll(client->socket, batch);
+        lock.lock();
+
+        if (!sent) break;
+    }
+
+    std::erase(m_clients, client);
+    m_clientCount = m_clients.size();
+}
+
+void TailServer::publish(const Log& log, std::chrono::system_clock::time_point time) {
+    if (!m_listening || m_clientCount == 0) return;
+
+    auto frame = std::make_shared<std::string>();
+    beginFrame(*frame, 0);
+    *frame += static_cast<char>(log.severity.m_value);
+    appendInt<int64_t>(*frame, std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+    appendString<uint16_t>(*frame, log.mod->getID());
+    appendString<uint16_t>(*frame, log.threadName);
+    appendString<uint32_t>(*frame, log.message);
+    endFrame(*frame, 0);
+
+    std::lock_guard lock(m_mutex);
+    for (auto& client : m_clients) {
+        if (client->queue.size() >= MAX_QUEUED_FRAMES || client->queuedBytes + frame->size() > MAX_QUEUED_BYTES) {
+            client->dropped++;
+        }
+        else {
+            client->queue.push_back(frame);
+            client->queuedBytes += frame->size();
+        }
+        client->cv.notify_one();
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Geode/Geode.hpp>
+#include "Console.hpp"
+
+using namespace geode::prelude;
+
+// Streams logs to clients connected on 127.0.0.1.
+// Every frame is a little-endian u32 payload length followed by the payload,
+// whose first byte is the frame type:
+//   0 (log):     u8 severity, i64 unix time in ms, u16 length + mod id,
+//                u16 length + thread name, u32 length + message
+//   1 (dropped): u64 number of frames dropped for this client since the last notice
+class TailServer {
+protected:
+    struct Client;
+
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<Client>> m_clients;
+    std::atomic<size_t> m_clientCount = 0;
+    // m_running asks the accept loop to keep going, m_listening is cleared once it has exited
+    std::atomic<bool> m_running = false;
+    std::atomic<bool> m_listening = false;
+    intptr_t m_listenSocket = -1;
+    std::thread m_acceptThread;
+
+    void acceptLoop();
+    void clientLoop(std::shared_ptr<Client> client);
+
+public:
+    static TailServer* get();
+
+    bool start(uint16_t port);
+    void stop();
+    bool isRunning();
+    void publish(const Log& log, std::chrono::system_clock::time_point time);
+};
@@ -1,6 +1,7 @@
 #include <Geode/Geode.hpp>
 #include <Geode/modify/MenuLayer.hpp>
 #include "Console.hpp"
+#include "TailServer.hpp"
 
 using namespace geode::prelude;
 
@@ -27,14 +28,18 @@ void vlogImpl_H(Severity severity, Mod* mod, fmt::string_view format, fmt::forma
     std::string level = geodeMod->getSettingValue<std::string>("console-log-level");
     if (severity < fromString(level)) return;
 
+    auto now = std::chrono::system_clock::now();
+
     Log log {
         mod,
         severity,
         fmt::vformat(format, args),
         thread::getName(),
-        convertTime(std::chrono::system_clock::now())
+        convertTime(now)
     };
 
+    TailServer::get()->publish(log, now);
+
     queueInMainThread([log] {
         if (auto console = Console::get()) {
             console->pushLog(log);
@@ -51,6 +56,19 @@ $on_mod(Loaded) {
     queueInMainThread([] {
         SceneManager::get()->keepAcrossScenes(Console::create());
     });
+
+    if (Mod::get()->getSettingValue<bool>("tail-server")) {
+        TailServer::get()->start(Mod::get()->getSettingValue<int64_t>("tail-server-port"));
+    }
+    listenForSettingChanges("tail-server", [](bool enabled) {
+        if (enabled) TailServer::get()->start(Mod::get()->getSettingValue<int64_t>("tail-server-port"));
+        else TailServer::get()->stop();
+    });
+    listenForSettingChanges("tail-server-port", [](int64_t port) {
+        if (!Mod::get()->getSettingValue<bool>("tail-server")) return;
+        TailServer::get()->stop();
+        TailServer::get()->start(port);
+    });
 }
 
 class $modify(MenuLayer) {
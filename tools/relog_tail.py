@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Prints logs streamed by Relog's tail server.
+
+Enable "Tail Server" in the mod settings, then run:
+
+    python3 relog_tail.py [--host 127.0.0.1] [--port 7373]
+
+On Android, forward the port first with `adb forward tcp:7373 tcp:7373`.
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+SEVERITIES = {0: "DEBUG", 1: "INFO ", 2: "WARN ", 3: "ERROR"}
+COLORS = {0: "\033[90m", 1: "\033[94m", 2: "\033[93m", 3: "\033[91m"}
+RESET = "\033[0m"
+
+
+def read_exact(sock, size):
+    data = bytearray()
+    while len(data) < size:
+        chunk = sock.recv(size - len(data))
+        if not chunk:
+            raise ConnectionError("connection closed")
+        data += chunk
+    return bytes(data)
+
+
+def read_string(payload, offset, length_format):
+    (length,) = struct.unpack_from(length_format, payload, offset)
+    offset += struct.calcsize(length_format)
+    value = payload[offset:offset + length].decode("utf-8", "replace")
+    return value, offset + length
+
+
+def format_log(payload, color):
+    severity, timestamp = struct.unpack_from("<Bq", payload, 1)
+    offset = 10
+    mod, offset = read_string(payload, offset, "<H")
+    thread, offset = read_string(payload, offset, "<H")
+    message, offset = read_string(payload, offset, "<I")
+
+    stamp = time.strftime("%H:%M:%S", time.localtime(timestamp / 1000))
+    prefix = f"{stamp} {SEVERITIES.get(severity, '?????')}"
+    prefix += f" [{thread}] [{mod}]: " if thread else f" [{mod}]: "
+
+    lines = message.split("\n")
+    text = prefix + lines[0]
+    for line in lines[1:]:
+        text += "\n" + " " * len(prefix) + line
+
+    if color:
+        return COLORS.get(severity, "") + text + RESET
+    return text
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Tail logs from Relog's tail server.")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=7373)
+    parser.add_argument("--no-color", action="store_true")
+    args = parser.parse_args()
+    color = not args.no_color and sys.stdout.isatty()
+
+    with socket.create_connection((args.host, args.port)) as sock:
+        while True:
+            (length,) = struct.unpack("<I", read_exact(sock, 4))
+            payload = read_exact(sock, length)
+
+            if payload[0] == 0:
+                print(format_log(payload, color), flush=True)
+            elif payload[0] == 1:
+                (dropped,) = struct.unpack_from("<Q", payload, 1)
+                print(f"-- {dropped} logs dropped --", file=sys.stderr, flush=True)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except (KeyboardInterrupt, ConnectionError):
+        pass